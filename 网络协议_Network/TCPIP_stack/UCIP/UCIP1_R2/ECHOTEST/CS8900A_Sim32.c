@@ -34,6 +34,7 @@ void RxEvent_Sim32(USHORT* FramePtr, short length)
 {
     memcpy(rx_buffer, FramePtr, length);
     rx_packet_size = length;
+    rx_stat = RX_EVENT_RX_OK;
 //    ProcessISQ();
 //    RxEthEvent();
     EthAdaptor.interrupt(&EthAdaptor);
@@ -96,6 +97,7 @@ USHORT ReadPP(USHORT ppAdress)
         break;
     case ppRxStat:
         data = rx_stat;
+        rx_stat = 0;        // The frame is consumed once its status is read.
         break;
     case ppRxLength:
         data = rx_packet_size;